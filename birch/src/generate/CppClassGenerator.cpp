@@ -114,6 +114,27 @@ void birch::CppClassGenerator::visit(const Class* o) {
     middle('(' << o->params << ')');
     if (header) {
       finish(";\n");
+
+      /* blank constructor, for reading images */
+      genSourceLine(o->loc);
+      line("explicit " << o->name << "_(const membirch::blank_t& blank_) :");
+      in();
+      in();
+      genSourceLine(o->loc);
+      start("base_type_(blank_)");
+      for (auto o : memberVariables) {
+        finish(',');
+        genSourceLine(o->loc);
+        start(o->name << "(membirch::make_blank<decltype(" << o->name <<
+            ")>())");
+      }
+      out();
+      out();
+      finish(" {");
+      in();
+      line("//");
+      out();
+      line("}\n");
     } else {
       finish(" :");
       in();
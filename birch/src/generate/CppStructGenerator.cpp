@@ -115,6 +115,43 @@ void birch::CppStructGenerator::visit(const Struct* o) {
     middle('(' << o->params << ')');
     if (header) {
       finish(";\n");
+
+      /* blank constructor, for reading images */
+      genSourceLine(o->loc);
+      start("explicit " << o->name << "(const membirch::blank_t&");
+      bool first = true;
+      if (!o->base->isEmpty()) {
+        finish(" blank_) :");
+        first = false;
+        in();
+        in();
+        genSourceLine(o->loc);
+        start("base_type_(blank_)");
+      } else {
+        middle(')');
+      }
+      for (auto o : memberVariables) {
+        if (first) {
+          finish(" :");
+          first = false;
+          in();
+          in();
+        } else {
+          finish(',');
+        }
+        genSourceLine(o->loc);
+        start(o->name << "(membirch::make_blank<decltype(" << o->name <<
+            ")>())");
+      }
+      if (!first) {
+        out();
+        out();
+      }
+      finish(" {");
+      in();
+      line("//");
+      out();
+      line("}\n");
     } else {
       ++inConstructor;
       bool first = true;
@@ -7,6 +7,7 @@ class BirchStandard < Formula
   license "Apache-2.0"
   depends_on "boost"
   depends_on "libyaml"
+  uses_from_macos "zlib"
   depends_on "membirch" => "0.0.0"
   depends_on "numbirch" => "0.0.0"
 
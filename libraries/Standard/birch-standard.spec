@@ -13,10 +13,10 @@ Source0: birch-standard-%{version}.tar.gz
 %endif
 
 %if 0%{?suse_version} || 0%{?fedora} || 0%{?rhel_version} || 0%{?centos_version}
-BuildRequires: gcc-c++ autoconf automake libtool birch == %{version} membirch-devel == %{version} numbirch-devel == %{version} libyaml-devel boost-devel
+BuildRequires: gcc-c++ autoconf automake libtool birch == %{version} membirch-devel == %{version} numbirch-devel == %{version} libyaml-devel zlib-devel boost-devel
 %endif
 %if 0%{?mageia}
-BuildRequires: gcc-c++ libgomp-devel autoconf automake libtool birch == %{version} membirch-devel == %{version} numbirch-devel == %{version} yaml-devel boost-devel
+BuildRequires: gcc-c++ libgomp-devel autoconf automake libtool birch == %{version} membirch-devel == %{version} numbirch-devel == %{version} yaml-devel zlib-devel boost-devel
 %endif
 
 %description
@@ -29,7 +29,7 @@ Shared libraries for the Birch standard library.
 
 %package devel
 Summary: Development files for the Birch standard library
-Requires: lib%{name}-0_0_0 == %{version} membirch-devel == %{version} numbirch-devel == %{version} libyaml-devel boost-devel
+Requires: lib%{name}-0_0_0 == %{version} membirch-devel == %{version} numbirch-devel == %{version} libyaml-devel zlib-devel boost-devel
 %description devel
 Development files for the Birch standard library.
 
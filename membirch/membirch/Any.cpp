@@ -14,6 +14,10 @@ membirch::Any::Any() :
   //
 }
 
+membirch::Any::Any(const blank_t&) : Any() {
+  //
+}
+
 membirch::Any::Any(const Any& o) : Any() {
   //  
 }
@@ -7,6 +7,7 @@
 #include "membirch/internal.hpp"
 #include "membirch/macro.hpp"
 #include "membirch/memory.hpp"
+#include "membirch/pool.hpp"
 #include "membirch/thread.hpp"
 #include "membirch/Atomic.hpp"
 #include "membirch/Marker.hpp"
@@ -19,6 +20,9 @@
 #include "membirch/Copier.hpp"
 #include "membirch/BiconnectedCopier.hpp"
 #include "membirch/Destroyer.hpp"
+#include "membirch/Serializer.hpp"
+#include "membirch/Deserializer.hpp"
+#include "membirch/blank.hpp"
 
 namespace membirch {
 /**
@@ -45,12 +49,19 @@ public:
   friend class BiconnectedCopier;
   friend class BiconnectedMemo;
   friend class Destroyer;
+  friend class Serializer;
+  friend class Deserializer;
  
   /**
    * Constructor.
    */
   Any();
 
+  /**
+   * Blank constructor.
+   */
+  Any(const blank_t&);
+
   /**
    * Copy constructor.
    */
@@ -66,6 +77,45 @@ public:
    */
   Any& operator=(const Any&);
 
+  /**
+   * @internal
+   * 
+   * Allocate an object from the pool of the calling thread.
+   */
+  static void* operator new(size_t size) {
+    return pool_allocate(size);
+  }
+
+  /**
+   * @internal
+   * 
+   * Allocate an object with extended alignment, e.g. one with a member
+   * declared `alignas(64)`.
+   */
+  static void* operator new(size_t size, std::align_val_t align) {
+    return pool_allocate(size, size_t(align));
+  }
+
+  /**
+   * @internal
+   * 
+   * Deallocate an object to the block from which it was allocated. As the
+   * destructor is virtual, `size` is that of the most-derived class.
+   */
+  static void operator delete(void* ptr, size_t size) {
+    pool_deallocate(ptr, size);
+  }
+
+  /**
+   * @internal
+   * 
+   * Deallocate an object with extended alignment.
+   */
+  static void operator delete(void* ptr, size_t size,
+      std::align_val_t align) {
+    pool_deallocate(ptr, size, size_t(align));
+  }
+
   /**
    * @internal
    * 
@@ -161,6 +211,10 @@ public:
     return membirch::make_object<Any>(*this);
   }
 
+  virtual const char* getTypeKey_() const {
+    return membirch::registered_type<Any>::key;
+  }
+
   virtual void accept_(membirch::Marker& visitor_) {
     //
   }
@@ -203,6 +257,14 @@ public:
     //
   }
 
+  virtual void accept_(membirch::Serializer& visitor_) {
+    //
+  }
+
+  virtual void accept_(membirch::Deserializer& visitor_) {
+    //
+  }
+
 private:
   /**
    * @internal
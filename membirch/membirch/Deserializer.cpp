@@ -0,0 +1,96 @@
+/**
+ * @file
+ */
+#include "membirch/Deserializer.hpp"
+
+#include "membirch/Any.hpp"
+
+membirch::Deserializer::Deserializer(const Image& image) :
+    image(image),
+    i(0),
+    r(0),
+    s(0) {
+  //
+}
+
+membirch::Shared<membirch::Any> membirch::Deserializer::visitObject() {
+  objects.clear();
+  i = 0;
+  r = 0;
+  s = 0;
+  message.clear();
+
+  if (image.types.empty()) {
+    fail("image has no objects");
+    return Shared<Any>(nullptr);
+  }
+
+  /* allocate all objects first, so that pointers to those not yet read, as
+   * in cycles, can be restored */
+  objects.reserve(image.types.size());
+  for (auto& type : image.types) {
+    Any* o = make_blank_object(type);
+    if (!o) {
+      fail("image has an object of type " + type + ", which cannot be " +
+          "read; the image may have been written by a different program");
+      return Shared<Any>(nullptr);
+    }
+    objects.emplace_back(o);
+  }
+  for (auto& o : objects) {
+    o.get()->accept_(*this);
+  }
+  if (i != image.integers.size() || r != image.reals.size() ||
+      s != image.strings.size()) {
+    fail("image has more values than its objects");
+  }
+
+  Shared<Any> root(nullptr);
+  if (message.empty()) {
+    root = objects.front();
+  }
+  objects.clear();
+  return root;
+}
+
+int membirch::Deserializer::readInteger() {
+  if (i < image.integers.size()) {
+    return image.integers[i++];
+  } else {
+    fail("image has too few integers");
+    return 0;
+  }
+}
+
+int membirch::Deserializer::readSize() {
+  int n = readInteger();
+  if (n < 0) {
+    fail("image has a negative size");
+    return 0;
+  }
+  return n;
+}
+
+double membirch::Deserializer::readReal() {
+  if (r < image.reals.size()) {
+    return image.reals[r++];
+  } else {
+    fail("image has too few reals");
+    return 0.0;
+  }
+}
+
+int membirch::Deserializer::readPointer() {
+  int j = readInteger();
+  if (j < 0 || j > int(objects.size())) {
+    fail("image has a pointer to an object that does not exist");
+    return -1;
+  }
+  return j - 1;
+}
+
+void membirch::Deserializer::fail(const std::string& msg) {
+  if (message.empty()) {
+    message = msg;
+  }
+}
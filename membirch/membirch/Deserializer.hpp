@@ -0,0 +1,220 @@
+/**
+ * @file
+ */
+#pragma once
+
+#include "membirch/external.hpp"
+#include "membirch/internal.hpp"
+#include "membirch/type.hpp"
+#include "membirch/blank.hpp"
+#include "membirch/Serializer.hpp"
+
+namespace membirch {
+/**
+ * @internal
+ *
+ * Read an image of a graph, as written by Serializer.
+ *
+ * All objects of the image are first allocated blank, by type key, so that
+ * pointers between them, including cyclic pointers, can be restored as they
+ * are read. The values of their members are then read in the order in which
+ * they were written. The image must have been written by the same program:
+ * if a type key is not registered, a pointer does not refer to an object of
+ * the expected type, or the image does not contain exactly the values read,
+ * reading fails, with a message in `error()`.
+ */
+class Deserializer {
+public:
+  /**
+   * Constructor.
+   *
+   * @param image Image to read.
+   */
+  Deserializer(const Image& image);
+
+  /**
+   * Read the image.
+   *
+   * @return The root object, or null if reading the image failed.
+   */
+  Shared<Any> visitObject();
+
+  /**
+   * Error message, if reading the image failed.
+   */
+  const std::string& error() const {
+    return message;
+  }
+
+  void visit() {
+    //
+  }
+
+  template<class T, std::enable_if_t<
+      is_visitable<T,Deserializer>::value,int> = 0>
+  void visit(T& o) {
+    o.accept_(*this);
+  }
+
+  template<class T, std::enable_if_t<
+      !is_visitable<T,Deserializer>::value &&
+      std::is_arithmetic<T>::value,int> = 0>
+  void visit(T& o) {
+    if constexpr (std::is_integral<T>::value && sizeof(T) <= sizeof(int) &&
+        !(std::is_unsigned<T>::value && sizeof(T) == sizeof(int))) {
+      o = T(readInteger());
+    } else {
+      o = T(readReal());
+    }
+  }
+
+  template<class T, std::enable_if_t<
+      !is_visitable<T,Deserializer>::value &&
+      is_array<T>::value,int> = 0>
+  void visit(T& o) {
+    if constexpr (T::ndims == 0) {
+      o = T(typename T::shape_type(0));
+    } else if constexpr (T::ndims == 1) {
+      int n = readSize();
+      o = T(typename T::shape_type(0, n));
+    } else {
+      int m = readSize();
+      int n = readSize();
+      o = T(typename T::shape_type(0, m, n, m));
+    }
+    if (o.size() > 0) {  // iterators do not support empty arrays
+      for (auto& value : o) {
+        visit(value);
+      }
+    }
+  }
+
+  template<class T, std::enable_if_t<
+      !is_visitable<T,Deserializer>::value &&
+      !std::is_arithmetic<T>::value &&
+      !is_array<T>::value,int> = 0>
+  void visit(T& o) {
+    fail(std::string("cannot read value of type ") + typeid(T).name());
+  }
+
+  template<class Arg, class... Args>
+  void visit(Arg& arg, Args&... args) {
+    visit(arg);
+    visit(args...);
+  }
+
+  void visit(std::string& o) {
+    if (s < image.strings.size()) {
+      o = image.strings[s++];
+    } else {
+      fail("image has too few strings");
+    }
+  }
+
+  template<class T>
+  void visit(std::vector<T>& o) {
+    int n = readSize();
+    o.clear();
+    o.reserve(n);
+    for (int i = 0; i < n; ++i) {
+      o.push_back(make_blank<T>());
+      visit(o.back());
+    }
+  }
+
+  template<class K, class V>
+  void visit(std::unordered_map<K,V>& o) {
+    int n = readSize();
+    o.clear();
+    for (int i = 0; i < n; ++i) {
+      auto key = make_blank<K>();
+      auto value = make_blank<V>();
+      visit(key, value);
+      o.emplace(std::move(key), std::move(value));
+    }
+  }
+
+  template<class... Args>
+  void visit(std::tuple<Args...>& o) {
+    std::apply([&](Args&... args) { return visit(args...); }, o);
+  }
+
+  template<class T>
+  void visit(std::optional<T>& o) {
+    if (readInteger()) {
+      o.emplace(make_blank<T>());
+      visit(o.value());
+    } else {
+      o.reset();
+    }
+  }
+
+  template<class T>
+  void visit(Shared<T>& o);
+
+private:
+  /**
+   * Read an integer.
+   */
+  int readInteger();
+
+  /**
+   * Read a size, which must be non-negative.
+   */
+  int readSize();
+
+  /**
+   * Read a real.
+   */
+  double readReal();
+
+  /**
+   * Read a pointer, as an index into `objects`, or -1 if null.
+   */
+  int readPointer();
+
+  /**
+   * Record a failure, if there is not one already.
+   */
+  void fail(const std::string& msg);
+
+  /**
+   * Image.
+   */
+  const Image& image;
+
+  /**
+   * Objects of the image, in order.
+   */
+  std::vector<Shared<Any>> objects;
+
+  /**
+   * Positions in the integers, reals and strings of the image.
+   */
+  size_t i, r, s;
+
+  /**
+   * Error message.
+   */
+  std::string message;
+};
+}
+
+#include "membirch/Shared.hpp"
+
+template<class T>
+void membirch::Deserializer::visit(Shared<T>& o) {
+  int j = readPointer();
+  if (j >= 0) {
+    auto ptr = dynamic_cast<T*>(objects[j].get());
+    if (ptr) {
+      o = Shared<T>(ptr);
+    } else {
+      fail(std::string("image has an object of type ") + image.types[j] +
+          " where one of type " + typeid(T).name() + " is expected");
+      o.release();
+    }
+  } else {
+    o.release();
+  }
+}
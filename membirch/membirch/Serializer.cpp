@@ -0,0 +1,49 @@
+/**
+ * @file
+ */
+#include "membirch/Serializer.hpp"
+
+#include "membirch/Any.hpp"
+
+membirch::Serializer::Serializer(Image& image) :
+    image(image) {
+  //
+}
+
+bool membirch::Serializer::visitObject(Any* o) {
+  image.types.clear();
+  image.integers.clear();
+  image.reals.clear();
+  image.strings.clear();
+  objects.clear();
+  indexes.clear();
+  message.clear();
+
+  index(o);
+
+  /* objects are appended as they are first reached, so this is a
+   * breadth-first traversal; iterate by index, as the vector may be resized
+   * during the call to accept_() below */
+  for (size_t n = 0; n < objects.size(); ++n) {
+    objects[n]->accept_(*this);
+  }
+  return message.empty();
+}
+
+int membirch::Serializer::index(Any* o) {
+  if (!o) {
+    return 0;
+  }
+  auto [iter, inserted] = indexes.try_emplace(o, int(objects.size()) + 1);
+  if (inserted) {
+    objects.push_back(o);
+    image.types.push_back(o->getTypeKey_());
+  }
+  return iter->second;
+}
+
+void membirch::Serializer::fail(const std::string& msg) {
+  if (message.empty()) {
+    message = msg;
+  }
+}
@@ -0,0 +1,212 @@
+/**
+ * @file
+ */
+#pragma once
+
+#include "membirch/external.hpp"
+#include "membirch/internal.hpp"
+#include "membirch/type.hpp"
+
+#include <unordered_map>
+
+namespace membirch {
+/**
+ * Image of a graph, as written by Serializer and read by Deserializer.
+ *
+ * The image lists the type of each object reachable from the root, the root
+ * first, then the values of the members of all objects, in the order in
+ * which they are visited, in one sequence per kind of value. Pointers are
+ * written as the one-based index of their referent in the list of objects,
+ * or zero if null, so that shared and cyclic references are restored as
+ * such.
+ */
+struct Image {
+  /**
+   * Type keys of the objects, as returned by `getTypeKey_()`.
+   */
+  std::vector<std::string> types;
+
+  /**
+   * Boolean and integer values up to the width of `int`, pointers, and the
+   * sizes of arrays and containers.
+   */
+  std::vector<int> integers;
+
+  /**
+   * Floating point values, and integer values wider than `int`, which are
+   * exact up to 2^53 in magnitude.
+   */
+  std::vector<double> reals;
+
+  /**
+   * Strings.
+   */
+  std::vector<std::string> strings;
+};
+
+/**
+ * @internal
+ *
+ * Write an image of a graph.
+ *
+ * Objects are visited through `get()`, as on any other use, so that lazy
+ * copies are resolved and the image is of the graph as seen through the
+ * root. Members of types other than arithmetic types, strings, arrays,
+ * vectors, maps, optionals, tuples, pointers and visitable structs cannot be
+ * written; the image then fails, with the name of the first such type in
+ * `error()`.
+ */
+class Serializer {
+public:
+  /**
+   * Constructor.
+   *
+   * @param image Image to write.
+   */
+  Serializer(Image& image);
+
+  /**
+   * Write the image of the graph reachable from an object.
+   *
+   * @param o The root object.
+   *
+   * @return Did writing the image succeed?
+   */
+  bool visitObject(Any* o);
+
+  /**
+   * Error message, if writing the image failed.
+   */
+  const std::string& error() const {
+    return message;
+  }
+
+  void visit() {
+    //
+  }
+
+  template<class T, std::enable_if_t<
+      is_visitable<T,Serializer>::value,int> = 0>
+  void visit(T& o) {
+    o.accept_(*this);
+  }
+
+  template<class T, std::enable_if_t<
+      !is_visitable<T,Serializer>::value &&
+      std::is_arithmetic<T>::value,int> = 0>
+  void visit(T& o) {
+    if constexpr (std::is_integral<T>::value && sizeof(T) <= sizeof(int) &&
+        !(std::is_unsigned<T>::value && sizeof(T) == sizeof(int))) {
+      image.integers.push_back(int(o));
+    } else {
+      image.reals.push_back(double(o));
+    }
+  }
+
+  template<class T, std::enable_if_t<
+      !is_visitable<T,Serializer>::value &&
+      is_array<T>::value,int> = 0>
+  void visit(T& o) {
+    const T& x = o;  // const, so as not to trigger copy-on-write
+    if constexpr (T::ndims >= 1) {
+      image.integers.push_back(x.rows());
+    }
+    if constexpr (T::ndims >= 2) {
+      image.integers.push_back(x.columns());
+    }
+    if (x.size() > 0) {  // iterators do not support empty arrays
+      for (auto& value : x) {
+        visit(const_cast<typename T::value_type&>(value));
+      }
+    }
+  }
+
+  template<class T, std::enable_if_t<
+      !is_visitable<T,Serializer>::value &&
+      !std::is_arithmetic<T>::value &&
+      !is_array<T>::value,int> = 0>
+  void visit(T& o) {
+    fail(std::string("cannot write value of type ") + typeid(T).name());
+  }
+
+  template<class Arg, class... Args>
+  void visit(Arg& arg, Args&... args) {
+    visit(arg);
+    visit(args...);
+  }
+
+  void visit(std::string& o) {
+    image.strings.push_back(o);
+  }
+
+  template<class T>
+  void visit(std::vector<T>& o) {
+    image.integers.push_back(o.size());
+    for (auto& value : o) {
+      visit(value);
+    }
+  }
+
+  template<class K, class V>
+  void visit(std::unordered_map<K,V>& o) {
+    image.integers.push_back(o.size());
+    for (auto& [key, value] : o) {
+      visit(const_cast<K&>(key), value);
+    }
+  }
+
+  template<class... Args>
+  void visit(std::tuple<Args...>& o) {
+    std::apply([&](Args&... args) { return visit(args...); }, o);
+  }
+
+  template<class T>
+  void visit(std::optional<T>& o) {
+    image.integers.push_back(o.has_value());
+    if (o.has_value()) {
+      visit(o.value());
+    }
+  }
+
+  template<class T>
+  void visit(Shared<T>& o);
+
+private:
+  /**
+   * Index of an object, adding it to the image if not already there.
+   */
+  int index(Any* o);
+
+  /**
+   * Record a failure, if there is not one already.
+   */
+  void fail(const std::string& msg);
+
+  /**
+   * Image.
+   */
+  Image& image;
+
+  /**
+   * Objects of the image, in order.
+   */
+  std::vector<Any*> objects;
+
+  /**
+   * Index of each object of the image.
+   */
+  std::unordered_map<Any*,int> indexes;
+
+  /**
+   * Error message.
+   */
+  std::string message;
+};
+}
+
+#include "membirch/Shared.hpp"
+
+template<class T>
+void membirch::Serializer::visit(Shared<T>& o) {
+  image.integers.push_back(index(o.get()));
+}
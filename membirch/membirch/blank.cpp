@@ -0,0 +1,28 @@
+/**
+ * @file
+ */
+#include "membirch/blank.hpp"
+
+#include <unordered_map>
+
+/**
+ * Registry of types, mapping keys to factory functions.
+ */
+static std::unordered_map<std::string,membirch::Any*(*)()>& types() {
+  static std::unordered_map<std::string,membirch::Any*(*)()> types;
+  return types;
+}
+
+const char* membirch::register_type(const char* key, Any* (*f)()) {
+  types()[key] = f;
+  return key;
+}
+
+membirch::Any* membirch::make_blank_object(const std::string& key) {
+  auto iter = types().find(key);
+  if (iter != types().end()) {
+    return iter->second();
+  } else {
+    return nullptr;
+  }
+}
@@ -0,0 +1,133 @@
+/**
+ * @file
+ */
+#pragma once
+
+#include "membirch/external.hpp"
+
+namespace membirch {
+class Any;
+
+template<class T>
+class Shared;
+
+/**
+ * Tag type for the constructor of an object or struct that gives all of its
+ * members blank values, to be overwritten, e.g. by Deserializer.
+ */
+struct blank_t {
+  explicit constexpr blank_t() = default;
+};
+
+/**
+ * Tag value for blank constructors.
+ */
+inline constexpr blank_t blank{};
+
+/**
+ * @internal
+ *
+ * Blank value of a member of type `T`. This is the blank-constructed value
+ * for types that have a blank constructor, the default-constructed value
+ * otherwise, and a null pointer for Shared, so that no object is allocated
+ * that would be overwritten anyway.
+ */
+template<class T>
+struct blank_value {
+  static T make() {
+    if constexpr (std::is_constructible<T,const blank_t&>::value) {
+      return T(blank);
+    } else {
+      return T();
+    }
+  }
+};
+
+template<class T>
+struct blank_value<Shared<T>> {
+  static Shared<T> make() {
+    return Shared<T>(nullptr);
+  }
+};
+
+template<class T>
+struct blank_value<std::optional<T>> {
+  static std::optional<T> make() {
+    return std::nullopt;
+  }
+};
+
+template<class... Args>
+struct blank_value<std::tuple<Args...>> {
+  static std::tuple<Args...> make() {
+    return std::tuple<Args...>(blank_value<Args>::make()...);
+  }
+};
+
+/**
+ * Blank value of a member of type `T`, for blank constructors.
+ */
+template<class T>
+T make_blank() {
+  return blank_value<T>::make();
+}
+
+/**
+ * @internal
+ *
+ * Allocate a blank object of type `T`, or return `nullptr` if `T` is
+ * abstract or has no blank constructor.
+ */
+template<class T>
+Any* make_blank_object() {
+  if constexpr (!std::is_abstract<T>::value &&
+      std::is_constructible<T,const blank_t&>::value) {
+    return new T(blank);
+  } else {
+    return nullptr;
+  }
+}
+
+/**
+ * @internal
+ *
+ * Register a type for make_blank_object(const std::string&).
+ *
+ * @param key Key of the type.
+ * @param f Factory function for blank objects of the type.
+ *
+ * @return @p key.
+ */
+const char* register_type(const char* key, Any* (*f)());
+
+/**
+ * @internal
+ *
+ * Allocate a blank object of a registered type.
+ *
+ * @param key Key of the type, as returned by `getTypeKey_()` on an object of
+ * the type.
+ *
+ * @return The object, or `nullptr` if the type is not registered or cannot
+ * be blank-constructed.
+ */
+Any* make_blank_object(const std::string& key);
+
+/**
+ * @internal
+ *
+ * Registration of the type `T`. The key is the name of the type given by
+ * `typeid`, which is the same in every run of the same program. Each class
+ * refers to its key in its `getTypeKey_()` member function, which, being
+ * virtual, is instantiated with the class, so that every class of which an
+ * object can exist is registered at startup.
+ */
+template<class T>
+struct registered_type {
+  static const char* const key;
+};
+
+template<class T>
+const char* const registered_type<T>::key = register_type(typeid(T).name(),
+    &make_blank_object<T>);
+}
@@ -12,7 +12,11 @@
 #include <tuple>
 #include <optional>
 #include <memory>
+#include <new>
 #include <type_traits>
+#include <typeinfo>
+#include <string>
+#include <vector>
 
 #include <cassert>
 #include <cstdlib>
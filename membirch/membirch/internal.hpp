@@ -20,6 +20,8 @@ class Memo;
 class BiconnectedCopier;
 class BiconnectedMemo;
 class Destroyer;
+class Serializer;
+class Deserializer;
 
 /**
  * @internal
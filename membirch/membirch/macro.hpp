@@ -76,11 +76,17 @@ using no_base = void;
   friend class BiconnectedCopier; \
   friend class BiconnectedMemo; \
   friend class Destroyer; \
+  friend class Serializer; \
+  friend class Deserializer; \
   \
   virtual const char* getClassName_() const override { \
     return #Name; \
   } \
   \
+  virtual const char* getTypeKey_() const override { \
+    return membirch::registered_type<Name>::key; \
+  } \
+  \
   virtual Name* copy_() const override { \
     return membirch::make_object<Name>(*this); \
   }
@@ -175,6 +181,16 @@ using no_base = void;
   virtual void accept_(membirch::Destroyer& visitor_) override { \
     accept_base_(visitor_); \
     visitor_.visit(members); \
+  } \
+  \
+  virtual void accept_(membirch::Serializer& visitor_) override { \
+    accept_base_(visitor_); \
+    visitor_.visit(members); \
+  } \
+  \
+  virtual void accept_(membirch::Deserializer& visitor_) override { \
+    accept_base_(visitor_); \
+    visitor_.visit(members); \
   }
 
 /**
@@ -219,6 +235,8 @@ using no_base = void;
   friend class BiconnectedCopier; \
   friend class BiconnectedMemo; \
   friend class Destroyer; \
+  friend class Serializer; \
+  friend class Deserializer; \
   \
   const char* getClassName_() const { \
     return #Name; \
@@ -315,4 +333,14 @@ using no_base = void;
   void accept_(membirch::Destroyer& visitor_) { \
     accept_base_(visitor_); \
     visitor_.visit(members); \
+  } \
+  \
+  void accept_(membirch::Serializer& visitor_) { \
+    accept_base_(visitor_); \
+    visitor_.visit(members); \
+  } \
+  \
+  void accept_(membirch::Deserializer& visitor_) { \
+    accept_base_(visitor_); \
+    visitor_.visit(members); \
   }
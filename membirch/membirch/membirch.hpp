@@ -11,6 +11,7 @@
 #include "membirch/memory.hpp"
 #include "membirch/macro.hpp"
 #include "membirch/type.hpp"
+#include "membirch/blank.hpp"
 
 #include "membirch/Shared.hpp"
 #include "membirch/Any.hpp"
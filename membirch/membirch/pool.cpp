@@ -0,0 +1,366 @@
+/**
+ * @file
+ */
+#include "membirch/pool.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <new>
+
+/**
+ * Granularity of size classes, in bytes. This is also the alignment of
+ * allocations, and matches the default alignment of `operator new`.
+ */
+static constexpr size_t granularity = 16;
+
+/**
+ * Number of size classes; objects larger than `granularity*nclasses` bytes
+ * are not pooled.
+ */
+static constexpr size_t nclasses = 32;
+
+/**
+ * Size of blocks, in bytes. Blocks are also aligned to this, so that the
+ * block of an object is found by masking its address.
+ */
+static constexpr size_t block_size = 64*1024;
+
+/**
+ * Node of a free list, overlaid on the free memory itself.
+ */
+struct free_node {
+  free_node* next;
+};
+
+struct pool_t;
+
+/**
+ * Block of objects of one size class. The block is owned by the pool of one
+ * thread, which alone allocates from it. Objects freed by the owner go onto
+ * the local free list; objects freed by other threads go onto the remote
+ * free list, which the owner collects when the local free list runs out.
+ * Memory therefore always returns to the block it came from, and a block
+ * is returned to the operating system once all its objects are free.
+ */
+struct alignas(granularity) block_t {
+  /**
+   * Owning pool, or null if the block is orphaned by the exit of the
+   * owning thread.
+   */
+  std::atomic<pool_t*> owner;
+
+  /**
+   * Objects freed by threads other than the owner.
+   */
+  std::atomic<free_node*> remote;
+
+  /**
+   * Objects freed by the owner.
+   */
+  free_node* local;
+
+  /**
+   * Start of the part of the block not yet allocated.
+   */
+  char* bump;
+
+  /**
+   * Number of objects allocated and not yet freed, counting objects on the
+   * remote free list until they are collected.
+   */
+  size_t used;
+
+  /**
+   * Size class.
+   */
+  size_t c;
+
+  /**
+   * Neighbors in the list of blocks of the same size class in the owning
+   * pool, or the list of orphans.
+   */
+  block_t* prev;
+  block_t* next;
+
+  /**
+   * End of the block.
+   */
+  char* end() {
+    return reinterpret_cast<char*>(this) + block_size;
+  }
+
+  /**
+   * Is there space for another object, not counting the remote free list?
+   */
+  bool available() {
+    return local || bump + c*granularity <= end();
+  }
+
+  /**
+   * Move the remote free list onto the local free list.
+   */
+  void collect() {
+    auto node = remote.exchange(nullptr, std::memory_order_acquire);
+    while (node) {
+      auto next = node->next;
+      node->next = local;
+      local = node;
+      --used;
+      node = next;
+    }
+  }
+};
+
+/**
+ * Pool of a thread, holding the blocks of each size class that it owns. The
+ * first block of each list is the one from which objects are allocated.
+ */
+struct pool_t {
+  block_t* blocks[nclasses];
+};
+
+/**
+ * Release of the pool of a thread on its exit. Blocks that are free are
+ * released, and blocks that are still in use, e.g. by objects shared with
+ * other threads, are orphaned, to be adopted by another thread or released
+ * once free. This is kept apart from pool_t, so that the pool itself is
+ * trivially destructible and accessed without the guard of a thread-local
+ * with a destructor.
+ */
+struct pool_exit_t {
+  ~pool_exit_t();
+};
+
+/**
+ * Pool of each thread.
+ */
+static thread_local pool_t pool = {};
+
+/**
+ * Release of the pool of each thread, constructed on its first refill.
+ */
+static thread_local pool_exit_t pool_exit;
+
+/**
+ * Orphaned blocks of each size class, and mutex for them.
+ */
+static block_t* orphans[nclasses] = {};
+static std::mutex orphans_mutex;
+
+/**
+ * Size class of an allocation.
+ */
+static size_t size_class(const size_t size) {
+  return (size + granularity - 1)/granularity;
+}
+
+/**
+ * Block of an object.
+ */
+static block_t* block_of(void* ptr) {
+  return reinterpret_cast<block_t*>(reinterpret_cast<uintptr_t>(ptr) &
+      ~uintptr_t(block_size - 1));
+}
+
+/**
+ * Insert a block at the front of a list.
+ */
+static void push_front(block_t*& head, block_t* b) {
+  b->prev = nullptr;
+  b->next = head;
+  if (head) {
+    head->prev = b;
+  }
+  head = b;
+}
+
+/**
+ * Remove a block from a list.
+ */
+static void unlink(block_t*& head, block_t* b) {
+  if (b->prev) {
+    b->prev->next = b->next;
+  } else {
+    head = b->next;
+  }
+  if (b->next) {
+    b->next->prev = b->prev;
+  }
+}
+
+/**
+ * Allocate a new block for the calling thread.
+ */
+static block_t* make_block(const size_t c) {
+  auto b = static_cast<block_t*>(std::aligned_alloc(block_size,
+      block_size));
+  assert(b);
+  new (b) block_t();
+  b->owner.store(&pool, std::memory_order_relaxed);
+  b->remote.store(nullptr, std::memory_order_relaxed);
+  b->local = nullptr;
+  b->bump = reinterpret_cast<char*>(b) + sizeof(block_t);
+  b->used = 0;
+  b->c = c;
+  return b;
+}
+
+/**
+ * Release a block to the operating system.
+ */
+static void free_block(block_t* b) {
+  b->~block_t();
+  std::free(b);
+}
+
+/**
+ * Adopt an orphaned block with space, if any, for the calling thread.
+ * Orphans found to be free on the way are released.
+ */
+static block_t* adopt(const size_t c) {
+  std::lock_guard<std::mutex> lock(orphans_mutex);
+  auto& head = orphans[c - 1];
+  auto b = head;
+  while (b) {
+    auto next = b->next;
+    b->collect();
+    if (b->used == 0) {
+      unlink(head, b);
+      free_block(b);
+    } else if (b->available()) {
+      unlink(head, b);
+      b->owner.store(&pool, std::memory_order_release);
+      return b;
+    }
+    b = next;
+  }
+  return nullptr;
+}
+
+/**
+ * Find a block with space for the calling thread, when the first has none,
+ * and move it to the front. The remote free lists of all blocks are
+ * collected on the way, and blocks found to be free are released, other
+ * than one kept to allocate from.
+ */
+static block_t* refill(const size_t c) {
+  static_cast<void>(&pool_exit);  // construct, to release on thread exit
+  auto& head = pool.blocks[c - 1];
+  block_t* found = nullptr;
+  auto b = head;
+  while (b) {
+    auto next = b->next;
+    if (b->remote.load(std::memory_order_relaxed)) {
+      b->collect();
+    }
+    if (b->used == 0 && found) {
+      unlink(head, b);
+      free_block(b);
+    } else if (!found && b->available()) {
+      found = b;
+    }
+    b = next;
+  }
+  if (found) {
+    unlink(head, found);
+  } else {
+    found = adopt(c);
+    if (!found) {
+      found = make_block(c);
+    }
+  }
+  push_front(head, found);
+  return found;
+}
+
+pool_exit_t::~pool_exit_t() {
+  auto& blocks = pool.blocks;
+  for (size_t i = 0; i < nclasses; ++i) {
+    auto b = blocks[i];
+    while (b) {
+      auto next = b->next;
+      b->collect();
+      if (b->used == 0) {
+        free_block(b);
+      } else {
+        b->owner.store(nullptr, std::memory_order_release);
+        std::lock_guard<std::mutex> lock(orphans_mutex);
+        push_front(orphans[i], b);
+      }
+      b = next;
+    }
+    blocks[i] = nullptr;
+  }
+}
+
+void* membirch::pool_allocate(const size_t size) {
+  auto c = size_class(size);
+  if (c == 0 || c > nclasses) {
+    return std::malloc(size);
+  }
+  auto b = pool.blocks[c - 1];
+  if (!b || !b->available()) {
+    if (b) {
+      b->collect();
+    }
+    if (!b || !b->available()) {
+      b = refill(c);
+    }
+  }
+  ++b->used;
+  if (b->local) {
+    auto node = b->local;
+    b->local = node->next;
+    return node;
+  } else {
+    auto ptr = b->bump;
+    b->bump += c*granularity;
+    return ptr;
+  }
+}
+
+void* membirch::pool_allocate(const size_t size, const size_t align) {
+  if (align <= granularity) {
+    return pool_allocate(size);
+  } else {
+    /* aligned_alloc() requires a size that is a multiple of the alignment */
+    return std::aligned_alloc(align, (size + align - 1)/align*align);
+  }
+}
+
+void membirch::pool_deallocate(void* ptr, const size_t size) {
+  auto c = size_class(size);
+  if (c == 0 || c > nclasses) {
+    std::free(ptr);
+  } else if (ptr) {
+    auto node = static_cast<free_node*>(ptr);
+    auto b = block_of(ptr);
+    assert(b->c == c);
+    if (b->owner.load(std::memory_order_acquire) == &pool) {
+      node->next = b->local;
+      b->local = node;
+      --b->used;
+      if (b->used == 0 && b != pool.blocks[c - 1]) {
+        /* keep the first block, to not thrash when one object is
+         * repeatedly allocated and freed */
+        unlink(pool.blocks[c - 1], b);
+        free_block(b);
+      }
+    } else {
+      auto head = b->remote.load(std::memory_order_relaxed);
+      do {
+        node->next = head;
+      } while (!b->remote.compare_exchange_weak(head, node,
+          std::memory_order_release, std::memory_order_relaxed));
+    }
+  }
+}
+
+void membirch::pool_deallocate(void* ptr, const size_t size,
+    const size_t align) {
+  if (align <= granularity) {
+    pool_deallocate(ptr, size);
+  } else {
+    std::free(ptr);
+  }
+}
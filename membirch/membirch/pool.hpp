@@ -0,0 +1,67 @@
+/**
+ * @file
+ */
+#pragma once
+
+#include "membirch/external.hpp"
+
+namespace membirch {
+/**
+ * @internal
+ *
+ * Allocate memory for an object from the pool of the calling thread.
+ *
+ * @param size Size of the object, in bytes.
+ *
+ * Objects up to a maximum size are allocated from blocks owned by the
+ * calling thread, each holding objects of one size class. This makes the
+ * many small, short-lived objects created in each step of a simulation (e.g.
+ * event handlers, Random and Distribution objects, boxed forms) cheap to
+ * allocate and release, and keeps the objects of one thread close in memory.
+ * Larger objects are allocated with `std::malloc()`.
+ */
+void* pool_allocate(const size_t size);
+
+/**
+ * @internal
+ *
+ * Allocate memory for an object with extended alignment.
+ *
+ * @param size Size of the object, in bytes.
+ * @param align Alignment of the object, in bytes.
+ *
+ * Objects with no more than the default alignment of `operator new` are
+ * allocated as for pool_allocate(size); others with `std::aligned_alloc()`.
+ */
+void* pool_allocate(const size_t size, const size_t align);
+
+/**
+ * @internal
+ *
+ * Deallocate memory for an object, returning it to the block from which it
+ * was allocated.
+ *
+ * @param ptr Pointer to the object.
+ * @param size Size of the object, in bytes, as given to pool_allocate().
+ *
+ * The calling thread need not be the thread that allocated the object; the
+ * memory is then returned to the block of the allocating thread, to be
+ * reused by that thread. A block is returned to the operating system once
+ * all of its objects are free. The blocks of a thread that exits while some
+ * of their objects are still in use are adopted by the next thread that
+ * needs a block of the same size class, or released once free.
+ */
+void pool_deallocate(void* ptr, const size_t size);
+
+/**
+ * @internal
+ *
+ * Deallocate memory for an object with extended alignment.
+ *
+ * @param ptr Pointer to the object.
+ * @param size Size of the object, in bytes, as given to pool_allocate().
+ * @param align Alignment of the object, in bytes, as given to
+ * pool_allocate().
+ */
+void pool_deallocate(void* ptr, const size_t size, const size_t align);
+}
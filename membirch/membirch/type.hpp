@@ -115,4 +115,29 @@ public:
       has_value_type<T>(0);
 };
 
+/**
+ * @internal
+ * 
+ * Is `T` an array of numbers? This is a type that provides a `value_type`
+ * member type that is arithmetic, a `shape_type` member type, and an
+ * `ndims` static member giving its number of dimensions, as for NumBirch
+ * arrays.
+ */
+template<class T>
+struct is_array {
+private:
+  template<class U>
+  static constexpr bool has_shape(typename U::shape_type*,
+      decltype(U::ndims)*) {
+    return std::is_arithmetic<typename U::value_type>::value;
+  }
+  template<class>
+  static constexpr bool has_shape(...) {
+    return false;
+  }
+
+public:
+  static constexpr bool value = has_shape<T>(0, 0);
+};
+
 }
@@ -3,7 +3,67 @@
  */
 #include "numbirch/common/random.hpp"
 
+#if HAVE_OMP_H
+#include <omp.h>
+#endif
+
+#include <sstream>
+#include <vector>
+
 namespace numbirch {
 thread_local std::mt19937 rng32;
 thread_local std::mt19937_64 rng64;
+
+std::string get_rng_state() {
+  #if HAVE_OMP_H
+  std::vector<std::string> states(omp_get_max_threads());
+  #else
+  std::vector<std::string> states(1);
+  #endif
+  #pragma omp parallel num_threads(states.size())
+  {
+    #if HAVE_OMP_H
+    auto n = omp_get_thread_num();
+    #else
+    int n = 0;
+    #endif
+    std::ostringstream out;
+    out << rng32 << ' ' << rng64;
+    states[n] = out.str();
+  }
+  std::string state;
+  for (auto& s : states) {
+    state += s;
+    state += '\n';
+  }
+  return state;
+}
+
+bool set_rng_state(const std::string& state) {
+  std::vector<std::string> states;
+  std::istringstream in(state);
+  std::string line;
+  while (std::getline(in, line)) {
+    states.push_back(line);
+  }
+  #if HAVE_OMP_H
+  int N = omp_get_max_threads();
+  #else
+  int N = 1;
+  #endif
+  #pragma omp parallel num_threads(N)
+  {
+    #if HAVE_OMP_H
+    auto n = omp_get_thread_num();
+    #else
+    int n = 0;
+    #endif
+    if (n < int(states.size())) {
+      std::istringstream in(states[n]);
+      in >> rng32 >> rng64;
+    }
+  }
+  return int(states.size()) >= N;
+}
+
 }
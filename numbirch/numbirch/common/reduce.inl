@@ -6,6 +6,9 @@
 #include "numbirch/reduce.hpp"
 #include "numbirch/array.hpp"
 
+#include <cmath>
+#include <limits>
+
 namespace numbirch {
 
 struct count_functor {
@@ -22,6 +25,21 @@ struct count_grad_functor {
   }
 };
 
+template<class T>
+struct norm_exp_functor {
+  T l;
+  norm_exp_functor(const T& l) : l(l) {
+    //
+  }
+  template<class U>
+  NUMBIRCH_HOST_DEVICE real operator()(const U x) const {
+    /* NaN is treated as -inf, giving zero; this includes the case where all
+     * elements are -inf, and so is the log-sum-exp */
+    real y = real(x) - get(l);
+    return std::isnan(y) ? real(0) : std::exp(y);
+  }
+};
+
 struct sum_functor {
   template<class T>
   NUMBIRCH_HOST_DEVICE T operator()(const T x) const {
@@ -48,6 +66,13 @@ real_t<T> count_grad(const Array<real,0>& g, const Array<R,0>& y,
   return transform(x, count_grad_functor());
 }
 
+template<class T, class>
+Array<real,1> norm_exp(const Array<T,1>& x) {
+  prefetch(x);
+  auto l = log_sum_exp(x);
+  return transform(x, norm_exp_functor(sliced(l)));
+}
+
 template<class R, class T, class>
 real_t<T> sum_grad(const Array<real,0>& g, const Array<R,0>& y,
     const T& x) {
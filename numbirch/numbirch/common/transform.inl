@@ -153,6 +153,14 @@ struct atan_grad_functor {
   }
 };
 
+struct axpy_functor {
+  template<class T, class U, class V>
+  NUMBIRCH_HOST_DEVICE auto operator()(const T y, const U a, const V x)
+      const {
+    return a*x + y;
+  }
+};
+
 struct ceil_functor {
   template<class T>
   NUMBIRCH_HOST_DEVICE auto operator()(const T x) const {
@@ -873,6 +881,13 @@ real_t<U> add_grad2(const real_t<T,U>& g, const implicit_t<T,U>& z, const T& x,
   return aggregate<dimension_v<U>>(g);
 }
 
+template<class T, int D, class U, class>
+void add_inplace(Array<T,D>& x, const U& y) {
+  prefetch(x);
+  prefetch(y);
+  transform_inplace(x, y, add_functor());
+}
+
 template<class T, class>
 real_t<T> asin(const T& x) {
   prefetch(x);
@@ -897,6 +912,13 @@ real_t<T> atan_grad(const real_t<T>& g, const real_t<T>& y, const T& x) {
   return transform(g, x, atan_grad_functor());
 }
 
+template<class T, int D, class U, class V, class>
+void axpy(const U& a, const V& x, Array<T,D>& y) {
+  prefetch(x);
+  prefetch(y);
+  transform_inplace(y, a, x, axpy_functor());
+}
+
 template<class R, class T, class>
 explicit_t<R,T> cast(const T& x) {
   prefetch(x);
@@ -1241,6 +1263,13 @@ real_t<U> hadamard_grad2(const real_t<T,U>& g, const implicit_t<T,U>& z,
       hadamard_grad2_functor()));
 }
 
+template<class T, int D, class U, class>
+void hadamard_inplace(Array<T,D>& x, const U& y) {
+  prefetch(x);
+  prefetch(y);
+  transform_inplace(x, y, hadamard_functor());
+}
+
 template<class T, class>
 T neg(const T& x) {
   prefetch(x);
@@ -1359,6 +1388,13 @@ real_t<U> sub_grad2(const real_t<T,U>& g, const implicit_t<T,U>& z,
   return neg(aggregate<dimension_v<U>>(g));
 }
 
+template<class T, int D, class U, class>
+void sub_inplace(Array<T,D>& x, const U& y) {
+  prefetch(x);
+  prefetch(y);
+  transform_inplace(x, y, sub_functor());
+}
+
 template<class T, class>
 real_t<T> tan(const T& x) {
   prefetch(x);
@@ -10,7 +10,194 @@
 #include "numbirch/common/transform.inl"
 #include "numbirch/cuda/transform.inl"
 
+#include <cmath>
+#include <limits>
+
 namespace numbirch {
+/*
+ * Element of a log-weight vector, where NaN is treated as though `-inf`.
+ */
+template<class T>
+struct log_weight_functor {
+  log_weight_functor(const T* x, const int incx) :
+      x(x),
+      incx(incx) {
+    //
+  }
+  NUMBIRCH_HOST_DEVICE real operator()(const int i) const {
+    real xi = get(x, 0, i, incx);
+    return std::isnan(xi) ? -std::numeric_limits<real>::infinity() : xi;
+  }
+  const T* x;
+  int incx;
+};
+
+/*
+ * Sums of exponentials (r) and squared exponentials (q) of elements relative
+ * to the maximum, excluding elements equal to the maximum, which are instead
+ * counted (c). Keeping the maximum out of the sums avoids losing small values
+ * to rounding, e.g. for x = [1e-20, log(1e-20)].
+ */
+struct exp_sums {
+  real r;
+  real q;
+  int c;
+};
+
+struct exp_sums_add_functor {
+  NUMBIRCH_HOST_DEVICE exp_sums operator()(const exp_sums& a,
+      const exp_sums& b) const {
+    return exp_sums{a.r + b.r, a.q + b.q, a.c + b.c};
+  }
+};
+
+template<class T>
+struct exp_sums_functor {
+  exp_sums_functor(const T* x, const int incx, const real* mx) :
+      x(x),
+      incx(incx),
+      mx(mx) {
+    //
+  }
+  NUMBIRCH_HOST_DEVICE exp_sums operator()(const int i) const {
+    real xi = get(x, 0, i, incx);
+    real m = *mx;
+    real v = (xi < m) ? std::exp(xi - m) : real(0);
+    return exp_sums{v, v*v, (xi == m) ? 1 : 0};
+  }
+  const T* x;
+  int incx;
+  const real* mx;
+};
+
+/*
+ * Exponential of an element relative to the maximum. Elements equal to the
+ * maximum contribute exactly one, so that an infinite maximum gives weight
+ * to infinite elements only, while NaN contributes zero.
+ */
+template<class T>
+struct cumsum_exp_functor {
+  cumsum_exp_functor(const T* x, const int incx, const real* mx) :
+      x(x),
+      incx(incx),
+      mx(mx) {
+    //
+  }
+  NUMBIRCH_HOST_DEVICE real operator()(const int i) const {
+    real xi = get(x, 0, i, incx);
+    real m = *mx;
+    if (m == -std::numeric_limits<real>::infinity()) {
+      return real(0);
+    } else {
+      return (xi == m) ? real(1) : (xi < m) ? std::exp(xi - m) : real(0);
+    }
+  }
+  const T* x;
+  int incx;
+  const real* mx;
+};
+
+template<class T>
+__global__ void kernel_ess_log_sum_exp(const T* mx, const exp_sums* s,
+    T* ess, T* lsum) {
+  T m = *mx;
+  if (m == -std::numeric_limits<T>::infinity()) {
+    /* empty, or all elements are -inf or NaN */
+    *ess = T(0);
+    *lsum = m;
+  } else if (m == std::numeric_limits<T>::infinity()) {
+    *ess = T(1);
+    *lsum = m;
+  } else {
+    T r = s->r + (s->c - 1);
+    T q = s->q + (s->c - 1);
+    *ess = (r + 1)*(r + 1)/(q + 1);
+    *lsum = m + std::log1p(r);
+  }
+}
+
+/*
+ * Maximum of a log-weight vector, where NaN is treated as though `-inf`.
+ */
+template<class T>
+Array<real,0> nan_max(const Array<T,1>& x) {
+  auto n = length(x);
+  if (n == 0) {
+    return Array<real,0>(-std::numeric_limits<real>::infinity());
+  } else {
+    Array<real,0> mx;
+    auto elem = log_weight_functor<T>(sliced(x), stride(x));
+    auto count = cub::CountingInputIterator<int>(0);
+    auto y = cub::TransformInputIterator<real,decltype(elem),
+        decltype(count)>(count, elem);
+    void* tmp = nullptr;
+    size_t bytes = 0;
+    CUDA_CHECK(cub::DeviceReduce::Max(tmp, bytes, y, sliced(mx), n,
+        stream));
+    tmp = device_malloc(bytes);
+    CUDA_CHECK(cub::DeviceReduce::Max(tmp, bytes, y, sliced(mx), n,
+        stream));
+    device_free(tmp, bytes);
+    return mx;
+  }
+}
+
+template<class T, class>
+Array<real,1> cumsum_exp(const Array<T,1>& x) {
+  prefetch(x);
+  auto n = length(x);
+  Array<real,1> z(make_shape(n));
+  if (n > 0) {
+    auto mx = nan_max(x);
+    auto elem = cumsum_exp_functor<T>(sliced(x), stride(x), sliced(mx));
+    auto count = cub::CountingInputIterator<int>(0);
+    auto y = cub::TransformInputIterator<real,decltype(elem),
+        decltype(count)>(count, elem);
+    void* tmp = nullptr;
+    size_t bytes = 0;
+    CUDA_CHECK(cub::DeviceScan::InclusiveSum(tmp, bytes, y, sliced(z), n,
+        stream));
+    tmp = device_malloc(bytes);
+    CUDA_CHECK(cub::DeviceScan::InclusiveSum(tmp, bytes, y, sliced(z), n,
+        stream));
+    device_free(tmp, bytes);
+  }
+  return z;
+}
+
+template<class T, class>
+std::tuple<Array<real,0>,Array<real,0>,Array<real,0>> ess_log_sum_exp(
+    const Array<T,1>& x) {
+  prefetch(x);
+  auto n = length(x);
+  auto mx = nan_max(x);
+  Array<real,0> ess, lsum;
+  auto s = static_cast<exp_sums*>(device_malloc(sizeof(exp_sums)));
+  if (n > 0) {
+    auto elem = exp_sums_functor<T>(sliced(x), stride(x), sliced(mx));
+    auto count = cub::CountingInputIterator<int>(0);
+    auto y = cub::TransformInputIterator<exp_sums,decltype(elem),
+        decltype(count)>(count, elem);
+    void* tmp = nullptr;
+    size_t bytes = 0;
+    CUDA_CHECK(cub::DeviceReduce::Reduce(tmp, bytes, y, s, n,
+        exp_sums_add_functor(), exp_sums{0, 0, 0}, stream));
+    tmp = device_malloc(bytes);
+    CUDA_CHECK(cub::DeviceReduce::Reduce(tmp, bytes, y, s, n,
+        exp_sums_add_functor(), exp_sums{0, 0, 0}, stream));
+    device_free(tmp, bytes);
+  }
+  CUDA_LAUNCH(kernel_ess_log_sum_exp<<<1,1,0,stream>>>(sliced(mx), s,
+      sliced(ess), sliced(lsum)));
+  device_free(s, sizeof(exp_sums));
+  return std::make_tuple(ess, lsum, mx);
+}
+
+template<class T, class>
+Array<real,0> log_sum_exp(const Array<T,1>& x) {
+  return std::get<1>(ess_log_sum_exp(x));
+}
+
 
 template<class T, class>
 Array<int,0> count(const T& x) {
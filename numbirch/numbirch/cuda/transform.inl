@@ -171,6 +171,39 @@ auto transform(const T& x, const U& y, const V& z, Functor f) {
   }
 }
 
+/*
+ * Binary in-place transform, where the first argument also receives the
+ * result.
+ */
+template<class T, int D, class U, class Functor>
+void transform_inplace(Array<T,D>& x, const U& y, Functor f) {
+  auto m = width(x);
+  auto n = height(x);
+  if (m > 0 && n > 0) {
+    auto grid = make_grid(m, n);
+    auto block = make_block(m, n);
+    CUDA_LAUNCH(kernel_transform<<<grid,block,0,stream>>>(m, n, sliced(x),
+        stride(x), sliced(y), stride(y), sliced(x), stride(x), f));
+  }
+}
+
+/*
+ * Ternary in-place transform, where the first argument also receives the
+ * result.
+ */
+template<class T, int D, class U, class V, class Functor>
+void transform_inplace(Array<T,D>& x, const U& y, const V& z, Functor f) {
+  auto m = width(x);
+  auto n = height(x);
+  if (m > 0 && n > 0) {
+    auto grid = make_grid(m, n);
+    auto block = make_block(m, n);
+    CUDA_LAUNCH(kernel_transform<<<grid,block,0,stream>>>(m, n, sliced(x),
+        stride(x), sliced(y), stride(y), sliced(z), stride(z), sliced(x),
+        stride(x), f));
+  }
+}
+
 /*
  * Unary gather.
  */
@@ -6,7 +6,163 @@
 #include "numbirch/reduce.hpp"
 #include "numbirch/eigen/eigen.hpp"
 
+#include <cmath>
+#include <limits>
+#include <vector>
+#ifdef HAVE_OMP_H
+#include <omp.h>
+#endif
+
 namespace numbirch {
+/*
+ * Minimum number of elements before the reductions over log-weights below
+ * are parallelized across threads; below this, thread startup dominates.
+ */
+static constexpr int PARALLEL_REDUCE_MIN = 1 << 14;
+
+/*
+ * Maximum of a vector, where NaN is treated as though `-inf`.
+ */
+template<class T>
+real kernel_nan_max(const int n, const T* x, const int incx) {
+  real mx = -std::numeric_limits<real>::infinity();
+  #pragma omp parallel for simd reduction(max:mx) if(n >= PARALLEL_REDUCE_MIN)
+  for (int i = 0; i < n; ++i) {
+    real xi = get(x, 0, i, incx);
+    mx = (xi > mx) ? xi : mx;  // comparison is false for NaN, so ignored
+  }
+  return mx;
+}
+
+/*
+ * Sums of exponentials (r) and squared exponentials (q) of the elements of a
+ * vector relative to its maximum, excluding elements equal to the maximum,
+ * which are instead counted (c). Keeping the maximum out of the sums avoids
+ * losing small values to rounding, e.g. for x = [1e-20, log(1e-20)].
+ */
+template<class T>
+void kernel_exp_sums(const int n, const T* x, const int incx, const real mx,
+    real& r, real& q, int& c) {
+  real r1 = 0, q1 = 0;
+  int c1 = 0;
+  #pragma omp parallel for simd reduction(+:r1,q1,c1) \
+      if(n >= PARALLEL_REDUCE_MIN)
+  for (int i = 0; i < n; ++i) {
+    real xi = get(x, 0, i, incx);
+    real v = (xi < mx) ? std::exp(xi - mx) : real(0);
+    r1 += v;
+    q1 += v*v;
+    c1 += (xi == mx) ? 1 : 0;
+  }
+  r = r1;
+  q = q1;
+  c = c1;
+}
+
+/*
+ * Inclusive scan of exponentials of the elements of a vector relative to
+ * their maximum. Each thread scans a contiguous block, then the block totals
+ * are propagated in a second pass. Elements equal to the maximum contribute
+ * exactly one, so that an infinite maximum gives weight to infinite elements
+ * only, while NaN contributes zero.
+ */
+template<class T>
+void kernel_cumsum_exp(const int n, const T* x, const int incx,
+    const real mx, real* y, const int incy) {
+  std::vector<real> totals;
+  #pragma omp parallel if(n >= PARALLEL_REDUCE_MIN)
+  {
+    #ifdef HAVE_OMP_H
+    int nthreads = omp_get_num_threads();
+    int tid = omp_get_thread_num();
+    #else
+    int nthreads = 1;
+    int tid = 0;
+    #endif
+    #pragma omp single
+    totals.resize(nthreads + 1, real(0));
+
+    int first = int(int64_t(n)*tid/nthreads);
+    int last = int(int64_t(n)*(tid + 1)/nthreads);
+    real sum = 0;
+    for (int i = first; i < last; ++i) {
+      real xi = get(x, 0, i, incx);
+      sum += (xi == mx) ? real(1) : (xi < mx) ? std::exp(xi - mx) : real(0);
+      get(y, 0, i, incy) = sum;
+    }
+    totals[tid + 1] = sum;
+
+    #pragma omp barrier
+    #pragma omp single
+    for (int t = 1; t <= nthreads; ++t) {
+      totals[t] += totals[t - 1];
+    }
+
+    real offset = totals[tid];
+    if (offset != real(0)) {
+      for (int i = first; i < last; ++i) {
+        get(y, 0, i, incy) += offset;
+      }
+    }
+  }
+}
+
+template<class T, class>
+Array<real,1> cumsum_exp(const Array<T,1>& x) {
+  auto n = length(x);
+  real mx = (n > 0) ? kernel_nan_max(n, sliced(x), stride(x)) :
+      -std::numeric_limits<real>::infinity();
+  if (mx == -std::numeric_limits<real>::infinity()) {
+    /* empty, or all elements are -inf or NaN, so all weights are zero */
+    return Array<real,1>(make_shape(n), real(0));
+  } else {
+    Array<real,1> y(make_shape(n));
+    kernel_cumsum_exp(n, sliced(x), stride(x), mx, sliced(y), stride(y));
+    return y;
+  }
+}
+
+template<class T, class>
+std::tuple<Array<real,0>,Array<real,0>,Array<real,0>> ess_log_sum_exp(
+    const Array<T,1>& x) {
+  constexpr real inf = std::numeric_limits<real>::infinity();
+  auto n = length(x);
+  real mx = (n > 0) ? kernel_nan_max(n, sliced(x), stride(x)) : -inf;
+  if (mx == -inf) {
+    /* empty, or all elements are -inf or NaN */
+    return std::make_tuple(Array<real,0>(real(0)), Array<real,0>(-inf),
+        Array<real,0>(-inf));
+  } else if (mx == inf) {
+    return std::make_tuple(Array<real,0>(real(1)), Array<real,0>(inf),
+        Array<real,0>(inf));
+  } else {
+    real r, q;
+    int c;
+    kernel_exp_sums(n, sliced(x), stride(x), mx, r, q, c);
+    r += c - 1;
+    q += c - 1;
+    real ess = (r + 1)*(r + 1)/(q + 1);
+    real lsum = mx + std::log1p(r);
+    return std::make_tuple(Array<real,0>(ess), Array<real,0>(lsum),
+        Array<real,0>(mx));
+  }
+}
+
+template<class T, class>
+Array<real,0> log_sum_exp(const Array<T,1>& x) {
+  constexpr real inf = std::numeric_limits<real>::infinity();
+  auto n = length(x);
+  real mx = (n > 0) ? kernel_nan_max(n, sliced(x), stride(x)) : -inf;
+  if (mx == -inf || mx == inf) {
+    return mx;
+  } else {
+    real r, q;
+    int c;
+    kernel_exp_sums(n, sliced(x), stride(x), mx, r, q, c);
+    return mx + std::log1p(r + (c - 1));
+  }
+}
+
 
 template<class T, class>
 Array<int,0> count(const T& x) {
@@ -129,6 +129,30 @@ auto transform(const T& x, const U& y, const V& z, Functor f) {
   }
 }
 
+/*
+ * Binary in-place transform, where the first argument also receives the
+ * result.
+ */
+template<class T, int D, class U, class Functor>
+void transform_inplace(Array<T,D>& x, const U& y, Functor f) {
+  auto m = width(x);
+  auto n = height(x);
+  kernel_transform(m, n, sliced(x), stride(x), sliced(y), stride(y),
+      sliced(x), stride(x), f);
+}
+
+/*
+ * Ternary in-place transform, where the first argument also receives the
+ * result.
+ */
+template<class T, int D, class U, class V, class Functor>
+void transform_inplace(Array<T,D>& x, const U& y, const V& z, Functor f) {
+  auto m = width(x);
+  auto n = height(x);
+  kernel_transform(m, n, sliced(x), stride(x), sliced(y), stride(y),
+      sliced(z), stride(z), sliced(x), stride(x), f);
+}
+
 /*
  * Unary gather.
  */
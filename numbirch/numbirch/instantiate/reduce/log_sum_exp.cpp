@@ -0,0 +1,38 @@
+/**
+ * @file
+ */
+#ifdef BACKEND_CUDA
+#include "numbirch/cuda/transform.inl"
+#endif
+#ifdef BACKEND_EIGEN
+#include "numbirch/eigen/transform.inl"
+#endif
+#include "numbirch/common/reduce.inl"
+#ifdef BACKEND_CUDA
+#include "numbirch/cuda/reduce.inl"
+#endif
+#ifdef BACKEND_EIGEN
+#include "numbirch/eigen/reduce.inl"
+#endif
+
+#define REDUCE_LOG_SUM_EXP(f, D) \
+    REDUCE_LOG_SUM_EXP_SIG(f, D, real) \
+    REDUCE_LOG_SUM_EXP_SIG(f, D, int) \
+    REDUCE_LOG_SUM_EXP_SIG(f, D, bool)
+#define REDUCE_LOG_SUM_EXP_SIG(f, D, T) \
+    template NUMBIRCH_ARRAY(real, D) f<T,int>(const NUMBIRCH_ARRAY(T, 1)&);
+
+#define REDUCE_ESS_LOG_SUM_EXP(f) \
+    REDUCE_ESS_LOG_SUM_EXP_SIG(f, real) \
+    REDUCE_ESS_LOG_SUM_EXP_SIG(f, int) \
+    REDUCE_ESS_LOG_SUM_EXP_SIG(f, bool)
+#define REDUCE_ESS_LOG_SUM_EXP_SIG(f, T) \
+    template std::tuple<NUMBIRCH_ARRAY(real, 0),NUMBIRCH_ARRAY(real, 0), \
+        NUMBIRCH_ARRAY(real, 0)> f<T,int>(const NUMBIRCH_ARRAY(T, 1)&);
+
+namespace numbirch {
+REDUCE_LOG_SUM_EXP(cumsum_exp, 1)
+REDUCE_ESS_LOG_SUM_EXP(ess_log_sum_exp)
+REDUCE_LOG_SUM_EXP(log_sum_exp, 0)
+REDUCE_LOG_SUM_EXP(norm_exp, 1)
+}
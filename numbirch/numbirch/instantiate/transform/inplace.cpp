@@ -0,0 +1,49 @@
+/**
+ * @file
+ */
+#ifdef BACKEND_CUDA
+#include "numbirch/cuda/transform.inl"
+#endif
+#ifdef BACKEND_EIGEN
+#include "numbirch/eigen/transform.inl"
+#endif
+#include "numbirch/common/transform.inl"
+
+#define INPLACE(f) \
+    INPLACE_FIRST(f, real, real) \
+    INPLACE_FIRST(f, real, int) \
+    INPLACE_FIRST(f, real, bool) \
+    INPLACE_FIRST(f, int, int) \
+    INPLACE_FIRST(f, int, bool)
+#define INPLACE_FIRST(f, T, U) \
+    INPLACE_SECOND(f, T, U, 2) \
+    INPLACE_SECOND(f, T, U, 1) \
+    INPLACE_SIG(f, T, 0, NUMBIRCH_ARRAY(U, 0)) \
+    INPLACE_SIG(f, T, 0, U)
+#define INPLACE_SECOND(f, T, U, D) \
+    INPLACE_SIG(f, T, D, NUMBIRCH_ARRAY(U, D)) \
+    INPLACE_SIG(f, T, D, NUMBIRCH_ARRAY(U, 0)) \
+    INPLACE_SIG(f, T, D, U)
+#define INPLACE_SIG(f, T, D, U) \
+    template void f<T,D,U,int>(NUMBIRCH_ARRAY(T, D)&, const U&);
+
+#define AXPY(f) \
+    AXPY_FIRST(f, real) \
+    AXPY_FIRST(f, int) \
+    AXPY_FIRST(f, bool)
+#define AXPY_FIRST(f, V) \
+    AXPY_SECOND(f, V, 2) \
+    AXPY_SECOND(f, V, 1) \
+    AXPY_SECOND(f, V, 0)
+#define AXPY_SECOND(f, V, D) \
+    AXPY_SIG(f, real, D, NUMBIRCH_ARRAY(real, 0), NUMBIRCH_ARRAY(V, D)) \
+    AXPY_SIG(f, real, D, real, NUMBIRCH_ARRAY(V, D))
+#define AXPY_SIG(f, T, D, U, V) \
+    template void f<T,D,U,V,int>(const U&, const V&, NUMBIRCH_ARRAY(T, D)&);
+
+namespace numbirch {
+INPLACE(add_inplace)
+INPLACE(hadamard_inplace)
+INPLACE(sub_inplace)
+AXPY(axpy)
+}
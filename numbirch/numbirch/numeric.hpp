@@ -332,6 +332,133 @@ implicit_t<T,U> operator/(const T& x, const U& y) {
   return div(x, y);
 }
 
+/**
+ * Element-wise addition assignment.
+ * 
+ * @ingroup linalg
+ * 
+ * @tparam T Arithmetic type.
+ * @tparam D Number of dimensions.
+ * @tparam U Numeric type.
+ * 
+ * @param x Argument, overwritten with the result.
+ * @param y Argument.
+ * 
+ * @return @p x.
+ * 
+ * @see add_inplace()
+ */
+template<class T, int D, class U, class = std::enable_if_t<
+    std::is_same_v<implicit_t<Array<T,D>,U>,Array<T,D>>,int>>
+Array<T,D>& operator+=(Array<T,D>& x, const U& y) {
+  /* optimization for addition of scalar zero */
+  if constexpr (is_arithmetic_v<U>) {
+    if (value(y) == 0) {
+      return x;
+    }
+  }
+  add_inplace(x, y);
+  return x;
+}
+
+/**
+ * Element-wise addition assignment to a temporary, typically a view returned
+ * by Array::slice(), so that `x.slice(i) += y` updates the elements of `x`.
+ * 
+ * @ingroup linalg
+ */
+template<class T, int D, class U, class = std::enable_if_t<
+    std::is_same_v<implicit_t<Array<T,D>,U>,Array<T,D>>,int>>
+void operator+=(Array<T,D>&& x, const U& y) {
+  x += y;
+}
+
+/**
+ * Element-wise subtraction assignment.
+ * 
+ * @ingroup linalg
+ * 
+ * @tparam T Arithmetic type.
+ * @tparam D Number of dimensions.
+ * @tparam U Numeric type.
+ * 
+ * @param x Argument, overwritten with the result.
+ * @param y Argument.
+ * 
+ * @return @p x.
+ * 
+ * @see sub_inplace()
+ */
+template<class T, int D, class U, class = std::enable_if_t<
+    std::is_same_v<implicit_t<Array<T,D>,U>,Array<T,D>>,int>>
+Array<T,D>& operator-=(Array<T,D>& x, const U& y) {
+  /* optimization for subtraction of scalar zero */
+  if constexpr (is_arithmetic_v<U>) {
+    if (value(y) == 0) {
+      return x;
+    }
+  }
+  sub_inplace(x, y);
+  return x;
+}
+
+/**
+ * Element-wise subtraction assignment to a temporary, typically a view
+ * returned by Array::slice(), so that `x.slice(i) -= y` updates the elements
+ * of `x`.
+ * 
+ * @ingroup linalg
+ */
+template<class T, int D, class U, class = std::enable_if_t<
+    std::is_same_v<implicit_t<Array<T,D>,U>,Array<T,D>>,int>>
+void operator-=(Array<T,D>&& x, const U& y) {
+  x -= y;
+}
+
+/**
+ * Scalar multiplication assignment.
+ * 
+ * @ingroup linalg
+ * 
+ * @tparam T Arithmetic type.
+ * @tparam D Number of dimensions.
+ * @tparam U Scalar type.
+ * 
+ * @param x Argument, overwritten with the result.
+ * @param y Argument.
+ * 
+ * @return @p x.
+ * 
+ * @note As for operator*(), only multiplication by a scalar is supported;
+ * for element-wise multiplication in place, see hadamard_inplace().
+ * 
+ * @see hadamard_inplace()
+ */
+template<class T, int D, class U, class = std::enable_if_t<is_scalar_v<U> &&
+    std::is_same_v<implicit_t<Array<T,D>,U>,Array<T,D>>,int>>
+Array<T,D>& operator*=(Array<T,D>& x, const U& y) {
+  /* optimization for multiplication of scalar one */
+  if constexpr (is_arithmetic_v<U>) {
+    if (value(y) == 1) {
+      return x;
+    }
+  }
+  hadamard_inplace(x, y);
+  return x;
+}
+
+/**
+ * Scalar multiplication assignment to a temporary, typically a view returned
+ * by Array::slice(), so that `x.slice(i) *= y` updates the elements of `x`.
+ * 
+ * @ingroup linalg
+ */
+template<class T, int D, class U, class = std::enable_if_t<is_scalar_v<U> &&
+    std::is_same_v<implicit_t<Array<T,D>,U>,Array<T,D>>,int>>
+void operator*=(Array<T,D>&& x, const U& y) {
+  x *= y;
+}
+
 /**
  * Cholesky factorization of a symmetric positive definite matrix.
  * 
@@ -10,6 +10,8 @@
 #include "numbirch/array/Vector.hpp"
 #include "numbirch/array/Matrix.hpp"
 
+#include <string>
+
 namespace numbirch {
 /**
  * Seed pseudorandom number generators.
@@ -36,6 +38,30 @@ void seed(const int s);
  */
 void seed();
 
+/**
+ * Get the state of the host pseudorandom number generators.
+ * 
+ * @ingroup random
+ * 
+ * @return State, as text, with one line for each host thread.
+ * 
+ * The state of device generators, if any, is not included.
+ */
+std::string get_rng_state();
+
+/**
+ * Set the state of the host pseudorandom number generators.
+ * 
+ * @ingroup random
+ * 
+ * @param state State, as returned by get_rng_state().
+ * 
+ * @return Was the state of every host thread set? If `state` was obtained
+ * with fewer host threads than there are now, the generators of the
+ * remaining threads are left unchanged, and the result is false.
+ */
+bool set_rng_state(const std::string& state);
+
 /**
  * Simulate a Bernoulli distribution.
  *
@@ -8,6 +8,9 @@
 #include "numbirch/array/Vector.hpp"
 #include "numbirch/array/Matrix.hpp"
 
+#include <tuple>
+#include <utility>
+
 namespace numbirch {
 /**
  * Count non-zero elements.
@@ -42,9 +45,86 @@ template<class R, class T, class = std::enable_if_t<is_arithmetic_v<R> &&
 real_t<T> count_grad(const Array<real,0>& g, const Array<R,0>& y,
     const T& x);
 
+/**
+ * Cumulative sum of exponentials of elements, relative to the maximum
+ * element. That is, element $i$ of the result is $\sum_{j \leq i}
+ * \exp(x_j - \max(x))$. This is the unnormalized cumulative distribution of a
+ * vector of log-weights.
+ *
+ * @ingroup reduce
+ *
+ * @tparam T Arithmetic type.
+ *
+ * @param x Argument.
+ *
+ * @return Result.
+ *
+ * NaN elements are treated as though `-inf`.
+ */
+template<class T, class = std::enable_if_t<is_arithmetic_v<T>,int>>
+Array<real,1> cumsum_exp(const Array<T,1>& x);
+
+/**
+ * Effective sample size (ESS), logarithm of the sum of exponentials of
+ * elements, and maximum element, computed together in one reduction. For a
+ * vector of log-weights $x$, the ESS is
+ * $(\sum_i \exp x_i)^2/\sum_i \exp 2x_i$.
+ *
+ * @ingroup reduce
+ *
+ * @tparam T Arithmetic type.
+ *
+ * @param x Argument.
+ *
+ * @return Tuple giving the ESS, the logarithm of the sum, and the maximum.
+ * These are zero, `-inf` and `-inf` if @p x is empty or all its elements are
+ * `-inf`, and one, `inf` and `inf` if any element is `inf`. The maximum is
+ * needed for the sums anyway, and is returned as a bound on the log-weights,
+ * e.g. for rejection resampling.
+ *
+ * NaN elements are treated as though `-inf`.
+ */
+template<class T, class = std::enable_if_t<is_arithmetic_v<T>,int>>
+std::tuple<Array<real,0>,Array<real,0>,Array<real,0>> ess_log_sum_exp(
+    const Array<T,1>& x);
+
+/**
+ * Logarithm of the sum of exponentials of elements.
+ *
+ * @ingroup reduce
+ *
+ * @tparam T Arithmetic type.
+ *
+ * @param x Argument.
+ *
+ * @return Result. This is `-inf` if @p x is empty.
+ *
+ * The computation avoids overflow and underflow by factoring out the maximum
+ * element. NaN elements are treated as though `-inf`.
+ */
+template<class T, class = std::enable_if_t<is_arithmetic_v<T>,int>>
+Array<real,0> log_sum_exp(const Array<T,1>& x);
+
+/**
+ * Exponentiate and normalize elements, i.e. $\exp(x_i)/\sum_j \exp(x_j)$.
+ * This converts a vector of log-weights into a vector of normalized weights.
+ *
+ * @ingroup reduce
+ *
+ * @tparam T Arithmetic type.
+ *
+ * @param x Argument.
+ *
+ * @return Result.
+ *
+ * NaN elements are treated as though `-inf`.
+ */
+template<class T, class = std::enable_if_t<is_arithmetic_v<T>,int>>
+Array<real,1> norm_exp(const Array<T,1>& x);
+
 /**
  * Sum elements.
- * 
+ *
  * @ingroup reduce
  * 
  * @tparam T Numeric type.
@@ -616,6 +616,28 @@ template<class T, class U, class = std::enable_if_t<is_numeric_v<T> &&
 real_t<U> add_grad2(const real_t<T,U>& g, const implicit_t<T,U>& z,
     const T& x, const U& y);
 
+/**
+ * Element-wise addition, in place.
+ * 
+ * @ingroup transform
+ * 
+ * @tparam T Arithmetic type.
+ * @tparam D Number of dimensions.
+ * @tparam U Numeric type.
+ * 
+ * @param[in,out] x Argument, overwritten with the result.
+ * @param y Argument.
+ * 
+ * The buffer of @p x is copied only if it is shared with another array
+ * (copy-on-write), otherwise the result is written into it without
+ * allocation.
+ * 
+ * @see add(), operator+=()
+ */
+template<class T, int D, class U, class = std::enable_if_t<
+    std::is_same_v<implicit_t<Array<T,D>,U>,Array<T,D>>,int>>
+void add_inplace(Array<T,D>& x, const U& y);
+
 /**
  * Arc sine.
  * 
@@ -676,6 +698,29 @@ real_t<T> atan(const T& x);
 template<class T, class = std::enable_if_t<is_numeric_v<T>,int>>
 real_t<T> atan_grad(const real_t<T>& g, const real_t<T>& y, const T& x);
 
+/**
+ * Scaled element-wise addition, in place (BLAS-style `axpy`).
+ * 
+ * @ingroup transform
+ * 
+ * @tparam T Arithmetic type.
+ * @tparam D Number of dimensions.
+ * @tparam U Scalar type.
+ * @tparam V Numeric type.
+ * 
+ * @param a Scale.
+ * @param x Argument.
+ * @param[in,out] y Argument, overwritten with the result `a*x + y`.
+ * 
+ * The buffer of @p y is copied only if it is shared with another array
+ * (copy-on-write), otherwise the result is written into it without
+ * allocation.
+ */
+template<class T, int D, class U, class V, class = std::enable_if_t<
+    is_scalar_v<U> &&
+    std::is_same_v<implicit_t<Array<T,D>,U,V>,Array<T,D>>,int>>
+void axpy(const U& a, const V& x, Array<T,D>& y);
+
 /**
  * Cast.
  * 
@@ -1134,6 +1179,28 @@ template<class T, class U, class = std::enable_if_t<is_numeric_v<T> &&
 real_t<U> hadamard_grad2(const real_t<T,U>& g, const implicit_t<T,U>& z,
     const T& x, const U& y);
 
+/**
+ * Element-wise multiplication (Hadamard product), in place.
+ * 
+ * @ingroup transform
+ * 
+ * @tparam T Arithmetic type.
+ * @tparam D Number of dimensions.
+ * @tparam U Numeric type.
+ * 
+ * @param[in,out] x Argument, overwritten with the result.
+ * @param y Argument.
+ * 
+ * The buffer of @p x is copied only if it is shared with another array
+ * (copy-on-write), otherwise the result is written into it without
+ * allocation.
+ * 
+ * @see hadamard(), operator*=()
+ */
+template<class T, int D, class U, class = std::enable_if_t<
+    std::is_same_v<implicit_t<Array<T,D>,U>,Array<T,D>>,int>>
+void hadamard_inplace(Array<T,D>& x, const U& y);
+
 /**
  * Normalized incomplete beta.
  * 
@@ -1867,6 +1934,28 @@ template<class T, class U, class = std::enable_if_t<is_numeric_v<T> &&
 real_t<U> sub_grad2(const real_t<T,U>& g, const implicit_t<T,U>& z, const T& x,
     const U& y);
 
+/**
+ * Element-wise subtraction, in place.
+ * 
+ * @ingroup transform
+ * 
+ * @tparam T Arithmetic type.
+ * @tparam D Number of dimensions.
+ * @tparam U Numeric type.
+ * 
+ * @param[in,out] x Argument, overwritten with the result.
+ * @param y Argument.
+ * 
+ * The buffer of @p x is copied only if it is shared with another array
+ * (copy-on-write), otherwise the result is written into it without
+ * allocation.
+ * 
+ * @see sub(), operator-=()
+ */
+template<class T, int D, class U, class = std::enable_if_t<
+    std::is_same_v<implicit_t<Array<T,D>,U>,Array<T,D>>,int>>
+void sub_inplace(Array<T,D>& x, const U& y);
+
 /**
  * Tangent.
  * 